@@ -94,6 +94,22 @@ LIBAESNI_EXPORT void intel_AES_encdec128_CTR(const UCHAR *input, UCHAR *output,
 LIBAESNI_EXPORT void intel_AES_encdec192_CTR(const UCHAR *input, UCHAR *output, const UCHAR key[IAES_192_KEYSIZE], IAES_INOUT UCHAR ic[IAES_BLOCK_SIZE], size_t numBlocks);
 LIBAESNI_EXPORT void intel_AES_encdec256_CTR(const UCHAR *input, UCHAR *output, const UCHAR key[IAES_256_KEYSIZE], IAES_INOUT UCHAR ic[IAES_BLOCK_SIZE], size_t numBlocks);
 
+/* keyed hashing functions (PMAC1 over full 16 byte blocks) */
+/* input is pointer to data to be hashed */
+/* tag is pointer to buffer to be filled with 16 byte message fingerprint */
+/* key is pointer to hash key (sizes are 16 bytes for AES-128, 24 bytes for AES-192, 32 for AES-256) */
+/* numBlocks is number of 16 bytes blocks to process - zero blocks hashes the empty message */
+LIBAESNI_EXPORT void intel_AES_hash128_PMAC(IAES_IN const UCHAR *input, IAES_OUT UCHAR tag[IAES_BLOCK_SIZE], IAES_IN const UCHAR key[IAES_128_KEYSIZE], IAES_IN size_t numBlocks);
+LIBAESNI_EXPORT void intel_AES_hash192_PMAC(IAES_IN const UCHAR *input, IAES_OUT UCHAR tag[IAES_BLOCK_SIZE], IAES_IN const UCHAR key[IAES_192_KEYSIZE], IAES_IN size_t numBlocks);
+LIBAESNI_EXPORT void intel_AES_hash256_PMAC(IAES_IN const UCHAR *input, IAES_OUT UCHAR tag[IAES_BLOCK_SIZE], IAES_IN const UCHAR key[IAES_256_KEYSIZE], IAES_IN size_t numBlocks);
+
+/* fused CTR + hash: produces the same output as intel_AES_encdecXXX_CTR and the same tag as intel_AES_hashXXX_PMAC keyed with hashKey over that output */
+/* input is read once, output is hashed while it is still cache resident */
+/* hashKey must be independent from key, it has the same size as key */
+LIBAESNI_EXPORT void intel_AES_encdec128_CTR_PMAC(const UCHAR *input, UCHAR *output, const UCHAR key[IAES_128_KEYSIZE], const UCHAR hashKey[IAES_128_KEYSIZE], IAES_INOUT UCHAR ic[IAES_BLOCK_SIZE], IAES_OUT UCHAR tag[IAES_BLOCK_SIZE], size_t numBlocks);
+LIBAESNI_EXPORT void intel_AES_encdec192_CTR_PMAC(const UCHAR *input, UCHAR *output, const UCHAR key[IAES_192_KEYSIZE], const UCHAR hashKey[IAES_192_KEYSIZE], IAES_INOUT UCHAR ic[IAES_BLOCK_SIZE], IAES_OUT UCHAR tag[IAES_BLOCK_SIZE], size_t numBlocks);
+LIBAESNI_EXPORT void intel_AES_encdec256_CTR_PMAC(const UCHAR *input, UCHAR *output, const UCHAR key[IAES_256_KEYSIZE], const UCHAR hashKey[IAES_256_KEYSIZE], IAES_INOUT UCHAR ic[IAES_BLOCK_SIZE], IAES_OUT UCHAR tag[IAES_BLOCK_SIZE], size_t numBlocks);
+
 LIBAESNI_EXPORT unsigned long long intel_AES_rdtsc(void);
 
 #ifdef __cplusplus
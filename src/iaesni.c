@@ -357,6 +357,193 @@ void intel_AES_dec256_IGE(const UCHAR *cipherText, UCHAR *plainText, const UCHAR
     intel_AES_encdec256_IGE_(cipherText, plainText, key, iv, numBlocks, 0);
 }
 
+/* number of blocks handed to the asm kernels at once, small enough for the chunk to stay in L1 */
+#define IAES_PMAC_CHUNK_BLOCKS 64
+
+/* PMAC1 state, offsets follow the gray code order: offset_i = offset_{i-1} ^ L(ntz(i)) */
+typedef struct sPmacState_ {
+    const UCHAR *expanded_key;
+    CryptoFunc crypto_func;
+    i_aes_128 l_table[sizeof(size_t) * 8]; /* L(j) = E(0) * x^j */
+    i_aes_128 l_inv;                       /* E(0) * x^-1 */
+    i_aes_128 offset;
+    i_aes_128 sum;
+    size_t index; /* blocks absorbed so far */
+} sPmacState;
+
+/* multiply by x in GF(2^128), big endian bit order */
+static void iaes_gf_double(UCHAR out[IAES_BLOCK_SIZE], const UCHAR in[IAES_BLOCK_SIZE]) {
+    UCHAR carry = in[0] >> 7;
+    for (int i = 0; i < IAES_BLOCK_SIZE - 1; i++) {
+        out[i] = (UCHAR) ((in[i] << 1) | (in[i + 1] >> 7));
+    }
+    out[IAES_BLOCK_SIZE - 1] = (UCHAR) ((in[IAES_BLOCK_SIZE - 1] << 1) ^ (carry ? 0x87 : 0x00));
+}
+
+/* multiply by x^-1 in GF(2^128), big endian bit order */
+static void iaes_gf_halve(UCHAR out[IAES_BLOCK_SIZE], const UCHAR in[IAES_BLOCK_SIZE]) {
+    UCHAR carry = in[IAES_BLOCK_SIZE - 1] & 1;
+    for (int i = IAES_BLOCK_SIZE - 1; i > 0; i--) {
+        out[i] = (UCHAR) ((in[i] >> 1) | (in[i - 1] << 7));
+    }
+    out[0] = (UCHAR) ((in[0] >> 1) ^ (carry ? 0x80 : 0x00));
+    out[IAES_BLOCK_SIZE - 1] ^= (carry ? 0x43 : 0x00);
+}
+
+static void iaes_pmac_encrypt(sPmacState *state, i_aes_128 *blocks, size_t numBlocks) {
+    sAesData aesData;
+    aesData.in_block = (const UCHAR *) blocks;
+    aesData.out_block = (UCHAR *) blocks;
+    aesData.expanded_key = state->expanded_key;
+    aesData.num_blocks = numBlocks;
+    state->crypto_func(&aesData);
+}
+
+static void iaes_pmac_init(sPmacState *state, const UCHAR *expandedKey, CryptoFunc crypto_func) {
+    i_aes_128 l_block = {0, 0};
+    UCHAR cur[IAES_BLOCK_SIZE], next[IAES_BLOCK_SIZE];
+
+    state->expanded_key = expandedKey;
+    state->crypto_func = crypto_func;
+    iaes_pmac_encrypt(state, &l_block, 1);
+
+    memcpy(cur, l_block, sizeof(cur));
+    iaes_gf_halve(next, cur);
+    memcpy(state->l_inv, next, sizeof(next));
+    for (size_t j = 0; j < sizeof(state->l_table) / sizeof(*state->l_table); j++) {
+        memcpy(state->l_table[j], cur, sizeof(cur));
+        iaes_gf_double(next, cur);
+        memcpy(cur, next, sizeof(cur));
+    }
+
+    state->offset[0] = state->offset[1] = 0;
+    state->sum[0] = state->sum[1] = 0;
+    state->index = 0;
+}
+
+/* absorbs blocks that are known not to be the last block of the message */
+static void iaes_pmac_blocks(sPmacState *state, const UCHAR *input, size_t numBlocks) {
+    i_aes_128 chunk[IAES_PMAC_CHUNK_BLOCKS];
+
+    while (numBlocks > 0) {
+        size_t n = (numBlocks < IAES_PMAC_CHUNK_BLOCKS) ? numBlocks : IAES_PMAC_CHUNK_BLOCKS;
+
+        for (size_t i = 0; i < n; i++, input += IAES_BLOCK_SIZE) {
+            size_t ntz = 0;
+            for (size_t idx = ++state->index; !(idx & 1); idx >>= 1) {
+                ntz++;
+            }
+            state->offset[0] ^= state->l_table[ntz][0];
+            state->offset[1] ^= state->l_table[ntz][1];
+
+            memcpy(chunk[i], input, sizeof(chunk[i])); /* `input` can be unaligned */
+            chunk[i][0] ^= state->offset[0];
+            chunk[i][1] ^= state->offset[1];
+        }
+
+        iaes_pmac_encrypt(state, chunk, n);
+
+        for (size_t i = 0; i < n; i++) {
+            state->sum[0] ^= chunk[i][0];
+            state->sum[1] ^= chunk[i][1];
+        }
+        numBlocks -= n;
+    }
+}
+
+/* lastBlock is NULL for the empty message, which is hashed as a single padded partial block */
+static void iaes_pmac_final(sPmacState *state, const UCHAR *lastBlock, UCHAR *tag) {
+    i_aes_128 block;
+
+    if (lastBlock != NULL) {
+        memcpy(block, lastBlock, sizeof(block));
+        block[0] ^= state->l_inv[0];
+        block[1] ^= state->l_inv[1];
+    } else {
+        UCHAR pad[IAES_BLOCK_SIZE] = {0x80};
+        memcpy(block, pad, sizeof(block));
+    }
+    block[0] ^= state->sum[0];
+    block[1] ^= state->sum[1];
+
+    iaes_pmac_encrypt(state, &block, 1);
+    memcpy(tag, block, sizeof(block));
+}
+
+static void intel_AES_hash_PMAC_(const UCHAR *input, UCHAR *tag, const UCHAR *expandedKey, CryptoFunc crypto_func, size_t numBlocks) {
+    sPmacState state;
+    iaes_pmac_init(&state, expandedKey, crypto_func);
+
+    if (numBlocks == 0) {
+        iaes_pmac_final(&state, NULL, tag);
+        return;
+    }
+    iaes_pmac_blocks(&state, input, numBlocks - 1);
+    iaes_pmac_final(&state, input + (numBlocks - 1) * IAES_BLOCK_SIZE, tag);
+}
+
+void intel_AES_hash128_PMAC(const UCHAR *input, UCHAR *tag, const UCHAR *key, size_t numBlocks) {
+    DEFINE_ROUND_KEYS
+    iEncExpandKey128(key, expandedKey);
+    intel_AES_hash_PMAC_(input, tag, expandedKey, iEnc128, numBlocks);
+}
+
+void intel_AES_hash192_PMAC(const UCHAR *input, UCHAR *tag, const UCHAR *key, size_t numBlocks) {
+    DEFINE_ROUND_KEYS
+    iEncExpandKey192(key, expandedKey);
+    intel_AES_hash_PMAC_(input, tag, expandedKey, iEnc192, numBlocks);
+}
+
+void intel_AES_hash256_PMAC(const UCHAR *input, UCHAR *tag, const UCHAR *key, size_t numBlocks) {
+    DEFINE_ROUND_KEYS
+    iEncExpandKey256(key, expandedKey);
+    intel_AES_hash_PMAC_(input, tag, expandedKey, iEnc256, numBlocks);
+}
+
+/* runs CTR over one chunk at a time and hashes each output chunk before moving on */
+static void intel_AES_encdec_CTR_PMAC_(const UCHAR *input, UCHAR *output, const UCHAR *key, const UCHAR *expandedHashKey, UCHAR *ic, UCHAR *tag, size_t numBlocks,
+                                       ExpandFunc expand_func, CryptoFunc ctr_func, CryptoFunc hash_func) {
+    DEFINE_ROUND_KEYS
+    sAesData aesData;
+    sPmacState state;
+    expand_func(key, expandedKey);
+    aesData.expanded_key = expandedKey;
+    aesData.iv = ic;
+    iaes_pmac_init(&state, expandedHashKey, hash_func);
+
+    for (size_t done = 0; done < numBlocks;) {
+        size_t n = (numBlocks - done < IAES_PMAC_CHUNK_BLOCKS) ? numBlocks - done : IAES_PMAC_CHUNK_BLOCKS;
+        aesData.in_block = input + done * IAES_BLOCK_SIZE;
+        aesData.out_block = output + done * IAES_BLOCK_SIZE;
+        aesData.num_blocks = n;
+        ctr_func(&aesData);
+
+        /* the very last block is kept for iaes_pmac_final */
+        iaes_pmac_blocks(&state, aesData.out_block, (done + n == numBlocks) ? n - 1 : n);
+        done += n;
+    }
+
+    iaes_pmac_final(&state, (numBlocks > 0) ? output + (numBlocks - 1) * IAES_BLOCK_SIZE : NULL, tag);
+}
+
+void intel_AES_encdec128_CTR_PMAC(const UCHAR *input, UCHAR *output, const UCHAR *key, const UCHAR *hashKey, UCHAR *ic, UCHAR *tag, size_t numBlocks) {
+    DEFINE_ROUND_KEYS
+    iEncExpandKey128(hashKey, expandedKey);
+    intel_AES_encdec_CTR_PMAC_(input, output, key, expandedKey, ic, tag, numBlocks, iEncExpandKey128, iEnc128_CTR, iEnc128);
+}
+
+void intel_AES_encdec192_CTR_PMAC(const UCHAR *input, UCHAR *output, const UCHAR *key, const UCHAR *hashKey, UCHAR *ic, UCHAR *tag, size_t numBlocks) {
+    DEFINE_ROUND_KEYS
+    iEncExpandKey192(hashKey, expandedKey);
+    intel_AES_encdec_CTR_PMAC_(input, output, key, expandedKey, ic, tag, numBlocks, iEncExpandKey192, iEnc192_CTR, iEnc192);
+}
+
+void intel_AES_encdec256_CTR_PMAC(const UCHAR *input, UCHAR *output, const UCHAR *key, const UCHAR *hashKey, UCHAR *ic, UCHAR *tag, size_t numBlocks) {
+    DEFINE_ROUND_KEYS
+    iEncExpandKey256(hashKey, expandedKey);
+    intel_AES_encdec_CTR_PMAC_(input, output, key, expandedKey, ic, tag, numBlocks, iEncExpandKey256, iEnc256_CTR, iEnc256);
+}
+
 unsigned long long intel_AES_rdtsc(void) {
     return do_rdtsc();
 }
@@ -20,6 +20,10 @@ unsigned char test_cipher_256_cbc[64]={ 0xf5,0x8c,0x4c,0x04,0xd6,0xe5,0xf1,0xba,
 										0x39,0xf2,0x33,0x69,0xa9,0xd9,0xba,0xcf,0xa5,0x30,0xe2,0x63,0x04,0x23,0x14,0x61,
 										0xb2,0xeb,0x05,0xe2,0xc3,0x9b,0xe9,0xfc,0xda,0x6c,0x19,0x07,0x8c,0x6a,0x9d,0x1b};
 
+// PMAC-AES-128 test vectors, key and message are 0x00..0x0f
+unsigned char test_pmac_tag_128_empty[16] = { 0x43,0x99,0x57,0x2c,0xd6,0xea,0x53,0x41,0xb8,0xd3,0x58,0x76,0xa7,0x09,0x8a,0xf7};
+unsigned char test_pmac_tag_128_16b[16] =   { 0xeb,0xbd,0x82,0x2f,0xa4,0x58,0xda,0xf6,0xdf,0xda,0xd7,0xc2,0x7d,0xa7,0x63,0x38};
+
 void printhex(const unsigned char *s, size_t size){
     for (const unsigned char *end = s + size; s < end; s++) {
         printf("%x", *s);
@@ -73,11 +77,61 @@ void test_cbc_256(){
     free(testResult);
 }
 
+void test_pmac_128(){
+	unsigned int nblocks = 200;
+	unsigned char *testVector = malloc(nblocks * 16);
+	unsigned char *testResult = malloc(nblocks * 16);
+	unsigned char *testFused = malloc(nblocks * 16);
+	unsigned char tag[16], fused_tag[16];
+	unsigned char ic[16] = {0}, fused_ic[16] = {0};
+	int failed = 0;
+	unsigned int i;
+
+	intel_AES_hash128_PMAC(test_init_vector, tag, test_init_vector, 0);
+	if (memcmp(tag, test_pmac_tag_128_empty, 16) != 0)
+	{
+		printf("PMAC-AES-128 Empty Message Failed\n");
+		failed = 1;
+	}
+
+	intel_AES_hash128_PMAC(test_init_vector, tag, test_init_vector, 1);
+	if (memcmp(tag, test_pmac_tag_128_16b, 16) != 0)
+	{
+		printf("PMAC-AES-128 Single Block Failed\n");
+		failed = 1;
+	}
+
+	for (i=0;i<nblocks*16;i++)
+	{
+		testVector[i] = (unsigned char) i;
+	}
+
+	// the fused pass must match a CTR pass followed by a separate hash pass
+	intel_AES_encdec128_CTR(testVector, testResult, test_key_256, ic, nblocks);
+	intel_AES_hash128_PMAC(testResult, tag, test_key_256 + 16, nblocks);
+	intel_AES_encdec128_CTR_PMAC(testVector, testFused, test_key_256, test_key_256 + 16, fused_ic, fused_tag, nblocks);
+
+	if (memcmp(testResult, testFused, nblocks * 16) != 0 || memcmp(ic, fused_ic, 16) != 0 || memcmp(tag, fused_tag, 16) != 0)
+	{
+		printf("AES-CTR-128 + PMAC Fused Pass Failed\n");
+		failed = 1;
+	}
+
+	if (!failed)
+	{
+		printf("PMAC-AES-128 Successful\n");
+	}
+	free(testVector);
+	free(testResult);
+	free(testFused);
+}
+
 int main(){
 	int AES_ENABLED = check_for_aes_instructions();
 	if (AES_ENABLED == 1){
 		printf ("The CPU supports AES-NI\n");
 		test_cbc_256();
+		test_pmac_128();
         return EXIT_SUCCESS;
 	}
 	else{